@@ -31,6 +31,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <map>
 
 #include	"function.h"
 #include "externs.h"
@@ -152,6 +153,15 @@ extern "C" __declspec(dllexport) void __cdecl CNC_Handle_Player_Switch_To_AI(uin
 extern "C" __declspec(dllexport) void __cdecl CNC_Handle_Human_Team_Wins(uint64 player_id);
 extern "C" __declspec(dllexport) void __cdecl CNC_Start_Mission_Timer(int time);
 extern "C" __declspec(dllexport) bool __cdecl CNC_Get_Start_Game_Info(uint64 player_id, int &start_location_waypoint_index);
+extern "C" __declspec(dllexport) void __cdecl CNC_Set_Profiler(bool enable, const char *csv_file_name);
+extern "C" __declspec(dllexport) void __cdecl CNC_Set_Threat_Prescan(bool enable);
+extern "C" __declspec(dllexport) void __cdecl CNC_Set_Shape_Cache_Budget(unsigned int unit_bytes, unsigned int theater_bytes);
+extern "C" __declspec(dllexport) bool __cdecl CNC_Run_Replay_Benchmark(const char *content_directory, const char *record_file_name, int max_frames, CNCReplayBenchmarkStruct &results);
+extern "C" __declspec(dllexport) bool __cdecl CNC_Run_LCW_Benchmark(int passes, CNCLCWBenchmarkStruct &results);
+extern "C" __declspec(dllexport) bool __cdecl CNC_Run_CRC_Benchmark(int passes, CNCCRCBenchmarkStruct &results);
+extern "C" __declspec(dllexport) bool __cdecl CNC_Save_Background(const char *file_path_and_name);
+extern "C" __declspec(dllexport) bool __cdecl CNC_Is_Background_Saving(void);
+extern "C" __declspec(dllexport) void __cdecl CNC_Shutdown(void);
 
 
 
@@ -175,6 +185,7 @@ class DLLExportClass {
 		static void Set_Content_Directory(const char *dir);
 
 		static bool Get_Layer_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
+		static bool Get_Layer_Delta_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
 		static bool Get_Sidebar_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
 		static bool Start_Construction(uint64 player_id, int buildable_type, int buildable_id);
 		static bool Hold_Construction(uint64 player_id, int buildable_type, int buildable_id);
@@ -214,6 +225,11 @@ class DLLExportClass {
 		static void Cell_Class_Draw_It(CNCDynamicMapStruct *dynamic_map, int &entry_index, CellClass *cell_ptr, int xpixel, int ypixel, bool debug_output);
 		static bool Get_Dynamic_Map_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
 		static bool Get_Shroud_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
+		static bool Get_Dynamic_Map_Delta_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
+		static bool Get_Shroud_Delta_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
+		static bool Get_Profile_State(unsigned char *buffer_in, unsigned int buffer_size);
+		static bool Get_Shape_Cache_State(unsigned char *buffer_in, unsigned int buffer_size);
+		static void On_Shroud_Changed(CELL cell, unsigned int houses);
 		static bool Get_Occupier_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
 		static bool Get_Player_Info_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size);
 
@@ -264,6 +280,7 @@ class DLLExportClass {
 		static void Recalculate_Placement_Distances();
 				
 		static void Reset_Sidebars(void);
+		static void Reset_Delta_State(void);
 
 		static SidebarGlyphxClass *Get_Current_Context_Sidebar(HouseClass *player_ptr = NULL);
 
@@ -301,6 +318,12 @@ class DLLExportClass {
 
 		static void Calculate_Placement_Distances(BuildingTypeClass* placement_type, unsigned char* placement_distance);
 
+		static bool Export_Layers(unsigned char *buffer_in, unsigned int buffer_size, std::vector<std::pair<const void *, int> > *groups);
+		static void Get_Cell_Export_Rect(int &map_cell_x, int &map_cell_y, int &map_cell_width, int &map_cell_height);
+		static void Fill_Shroud_Entry(CELL cell, CNCShroudEntryStruct &shroud_entry);
+		static void Apply_Gap_Shroud(unsigned int *shroud_bits);
+		static void Unapply_Gap_Shroud(unsigned int const *shroud_bits);
+
 		static int CurrentDrawCount;
 		static int TotalObjectCount;
 		static int SortOrder;
@@ -322,6 +345,35 @@ class DLLExportClass {
 		*/
 		static SidebarGlyphxClass MultiplayerSidebars[MAX_PLAYERS];
 
+		/*
+		** Object records last sent to each client by the delta layer export, keyed by the root object pointer
+		*/
+		struct LayerBaselineStruct {
+			unsigned int Frame;
+			std::map<const void *, std::vector<CNCObjectStruct> > Objects;
+		};
+		static std::map<uint64, LayerBaselineStruct> LayerBaselines;
+		static unsigned int LayerDeltaFrame;
+		static std::vector<unsigned char> LayerScratch;
+
+		/*
+		** Cell state last sent to each client by the delta shroud and dynamic map exports. Shroud changes are flagged
+		** per house as they happen, while dynamic map cells are compared against the key of what was last sent
+		*/
+		struct CellBaselineStruct {
+			unsigned int Frame;
+			int MapCellX;
+			int MapCellY;
+			int MapCellWidth;
+			int MapCellHeight;
+			COORDINATE TacticalCoord;
+			std::vector<unsigned __int64> Keys;
+		};
+		static unsigned int ShroudDirty[MAP_CELL_TOTAL];
+		static CellBaselineStruct ShroudBaselines[HOUSE_COUNT];
+		static std::map<uint64, CellBaselineStruct> DynamicMapBaselines;
+		static unsigned int CellDeltaFrame;
+
 		static CELL MultiplayerStartPositions[MAX_PLAYERS];
 
 		static BuildingTypeClass *PlacementType[MAX_PLAYERS];
@@ -362,6 +414,13 @@ unsigned char DLLExportClass::SpecialKeyFlags[MAX_PLAYERS] = { 0U };
 DynamicVectorClass<char *> DLLExportClass::ModSearchPaths;
 std::set<int64> DLLExportClass::MessagesSent;
 bool DLLExportClass::GameOver = false;
+std::map<uint64, DLLExportClass::LayerBaselineStruct> DLLExportClass::LayerBaselines;
+unsigned int DLLExportClass::LayerDeltaFrame = 0;
+std::vector<unsigned char> DLLExportClass::LayerScratch;
+unsigned int DLLExportClass::ShroudDirty[MAP_CELL_TOTAL];
+DLLExportClass::CellBaselineStruct DLLExportClass::ShroudBaselines[HOUSE_COUNT];
+std::map<uint64, DLLExportClass::CellBaselineStruct> DLLExportClass::DynamicMapBaselines;
+unsigned int DLLExportClass::CellDeltaFrame = 0;
 
 
 
@@ -548,6 +607,11 @@ void On_Message(const char* message, float timeout_seconds, int64 id)
 	DLLExportClass::On_Message(PlayerPtr, message, timeout_seconds, MESSAGE_TYPE_DIRECT, id);
 }
 
+void On_Shroud_Changed(CELL cell, unsigned int houses)
+{
+	DLLExportClass::On_Shroud_Changed(cell, houses);
+}
+
 void On_Update_Map_Cell(int cell_x, int cell_y, const char* template_type_name)
 {
 	DLLExportClass::On_Update_Map_Cell(cell_x, cell_y, template_type_name);
@@ -804,6 +868,8 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Set_Multiplayer_Data(int scena
 
 	Special.ModernBalance = game_options.ModernBalance;
 
+	Special.IsThreatPrescan = game_options.ThreatPrescan;
+
 	/*
 	** Enable Counterstrike/Aftermath units
 	*/
@@ -1314,6 +1380,7 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Start_Instance_Variation(int s
 	}
 
 	DLLExportClass::Reset_Sidebars();
+	DLLExportClass::Reset_Delta_State();
 	DLLExportClass::Reset_Player_Context();
 	DLLExportClass::Calculate_Start_Positions();
 
@@ -1545,6 +1612,7 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Start_Custom_Instance(const ch
 	}
 
 	DLLExportClass::Reset_Sidebars();
+	DLLExportClass::Reset_Delta_State();
 	DLLExportClass::Reset_Player_Context();
 	DLLExportClass::Calculate_Start_Positions();
 
@@ -1676,6 +1744,11 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Advance_Instance(uint64 player
 		GlyphX_Debug_Print("CNC_Advance_Instance - RA");
 	}
 
+	/*
+	** Time the whole logic frame for the profiler. This covers every way out of this function.
+	*/
+	BenchScopeClass frame_bench(BENCH_GAME_FRAME);
+
 	/*
 	** Shouldn't really need to do this, but I like the idea of always running the main loop in the context of the same player.
 	** Might make tbe bugs more repeatable and consistent. ST - 3/15/2019 11:58AM
@@ -1960,6 +2033,64 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Save_Load(bool save, const cha
 }
 
 
+/**************************************************************************************************
+* CNC_Save_Background -- Save the game, writing the file out with a background thread
+*
+* In:   Name of the file to save to
+*
+* Out:  Was the save started?
+*
+*	The game is stored into memory before this returns, so the game can keep running while the file
+*	is compressed and written. Used for autosaves. Saving or loading again waits for the file to be
+*	finished.
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) bool __cdecl CNC_Save_Background(const char *file_path_and_name)
+{
+	if (file_path_and_name == NULL) {
+		return false;
+	}
+	return Save_Game_Background(file_path_and_name, "internal");
+}
+
+
+/**************************************************************************************************
+* CNC_Is_Background_Saving -- Is a background save still being written?
+*
+* In:
+*
+* Out:  True while the file from CNC_Save_Background is incomplete
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) bool __cdecl CNC_Is_Background_Saving(void)
+{
+	return Is_Background_Saving();
+}
+
+
+/**************************************************************************************************
+* CNC_Shutdown -- Stop the threads the .DLL has started, before it is unloaded
+*
+* In:
+*
+* Out:  
+*
+*       Waits for any background save to be written and for the worker threads to exit. This must be
+*       called before the .DLL is freed, since threads can't be waited on while it is being unloaded.
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) void __cdecl CNC_Shutdown(void)
+{
+	Finish_Background_Save();
+	WorkerPool.Shutdown();
+}
+
+
 /**************************************************************************************************
 * CNC_Set_Difficulty -- Set game difficulty
 *
@@ -2139,6 +2270,7 @@ extern "C" __declspec(dllexport) void __cdecl CNC_Start_Mission_Timer(int time)
 		if (!Scen.MissionTimer.Is_Active()) {
 			Scen.MissionTimer.Start();
 		}
+		Scen.Schedule_Mission_Timer();
 
 		Map.Redraw_Tab();
 	}
@@ -2162,6 +2294,197 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Get_Start_Game_Info(uint64 pla
 }
 
 
+/**************************************************************************************************
+* CNC_Set_Profiler -- Turn the frame profiler on or off
+*
+* In:   Should profiling be on?
+*       Optional file to write a comma separated line of timings to for every game frame
+*
+* Out:  
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) void __cdecl CNC_Set_Profiler(bool enable, const char *csv_file_name)
+{
+	Profiler.Enable(enable, csv_file_name);
+}
+
+
+/**************************************************************************************************
+* CNC_Set_Threat_Prescan -- Turn the parallel threat scans ahead of the object AI on or off
+*
+* In:   Should the threat scans be run ahead?
+*
+* Out:  
+*
+*       The objects that are about to look for a target have the scan run across the worker threads
+*       at the start of each logic frame. This changes which targets are picked, so the setting is
+*       kept with the game settings in Special, which the saved games and recordings carry along.
+*       Multiplayer games take it from the ThreatPrescan game option instead, so that every player
+*       runs the same mode, and this call is ignored for them.
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) void __cdecl CNC_Set_Threat_Prescan(bool enable)
+{
+	if (GAME_TO_PLAY != GAME_NORMAL) {
+		return;
+	}
+
+	Special.IsThreatPrescan = enable;
+
+	/*
+	** Special is restored from the backup every frame, so keep the backup in step
+	*/
+	if (SpecialBackup != NULL) {
+		SpecialBackup->IsThreatPrescan = enable;
+	}
+}
+
+
+/**************************************************************************************************
+* CNC_Set_Shape_Cache_Budget -- Set how much memory the uncompressed shapes may use
+*
+* In:   Bytes for the unit, building and animation shapes
+*       Bytes for the theater specific shapes
+*
+* Out:  
+*
+*       The caches are resized before the next game frame. The least recently used frames are dropped
+*       if they no longer fit.
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) void __cdecl CNC_Set_Shape_Cache_Budget(unsigned int unit_bytes, unsigned int theater_bytes)
+{
+	Set_Shape_Cache_Budget(unit_bytes, theater_bytes);
+}
+
+
+/**************************************************************************************************
+* CNC_Run_Replay_Benchmark -- Play back a game recording as fast as possible and time it
+*
+* In:   Content directory
+*       Recording file made with the game's record option
+*       Maximum number of frames to play, or zero to play to the end
+*       Results to fill in
+*
+* Out:  False if the recording couldn't be played
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) bool __cdecl CNC_Run_Replay_Benchmark(const char *content_directory, const char *record_file_name, int max_frames, CNCReplayBenchmarkStruct &results)
+{
+	memset(&results, 0, sizeof(results));
+
+	if (content_directory == NULL || record_file_name == NULL) {
+		return false;
+	}
+
+	DLLExportClass::Set_Content_Directory(content_directory);
+
+	ReplayBenchClass replay;
+	bool played = replay.Run(record_file_name, max_frames);
+
+	DLLExportClass::Reset_Delta_State();
+
+	if (!played) {
+		return false;
+	}
+
+	results.Complete = replay.Is_Complete();
+	results.Frames = replay.Frames();
+	results.TotalMicroseconds = replay.Total_Time();
+	results.FramesPerSecond = replay.Frames_Per_Second();
+	results.MedianFrameMicroseconds = replay.Percentile(50);
+	results.Percentile90FrameMicroseconds = replay.Percentile(90);
+	results.Percentile99FrameMicroseconds = replay.Percentile(99);
+	results.MaxFrameMicroseconds = replay.Max_Frame_Time();
+	results.FinalFrame = replay.Final_Frame();
+	results.FinalCRC = replay.Final_CRC();
+
+	for (int i = 0; i < REPLAY_RECENT_CRCS; i++) {
+		long frame = replay.Final_Frame() - (REPLAY_RECENT_CRCS - 1) + i;
+		if (frame >= 0) {
+			results.RecentCRCs[i] = Recorded_Game_CRC(frame);
+		}
+	}
+
+	return true;
+}
+
+
+/**************************************************************************************************
+* CNC_Run_LCW_Benchmark -- Time the LCW compressor and decompressor over the loaded game data
+*
+* In:   Number of times to decompress every sample
+*       Results to fill in
+*
+* Out:  False if there was no data to test, or if any of it didn't survive compression
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) bool __cdecl CNC_Run_LCW_Benchmark(int passes, CNCLCWBenchmarkStruct &results)
+{
+	memset(&results, 0, sizeof(results));
+
+	LCWBenchClass bench;
+	bench.Add_Shapes();
+	bench.Add_Icons();
+	bench.Add_Map();
+
+	if (bench.Samples() == 0) {
+		return false;
+	}
+
+	results.Verified = bench.Run(passes);
+	results.Samples = bench.Samples();
+	results.RawBytes = bench.Raw_Size();
+	results.PackedBytes = bench.Packed_Size();
+	results.CompressMicroseconds = bench.Compress_Time();
+	results.UncompressMicroseconds = bench.Uncompress_Time();
+	results.CompressKBPerSecond = bench.Compress_Rate();
+	results.UncompressKBPerSecond = bench.Uncompress_Rate();
+
+	return results.Verified;
+}
+
+
+/**************************************************************************************************
+* CNC_Run_CRC_Benchmark -- Time the CRC engine over map data and over type and rule names
+*
+* In:   Number of times to run each test
+*       Results to fill in
+*
+* Out:  False if any value didn't match the one calculated a byte at a time
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+extern "C" __declspec(dllexport) bool __cdecl CNC_Run_CRC_Benchmark(int passes, CNCCRCBenchmarkStruct &results)
+{
+	memset(&results, 0, sizeof(results));
+
+	CRCBenchClass bench;
+	results.Verified = bench.Run(passes);
+	results.BulkBytes = bench.Bulk_Size();
+	results.BulkMicroseconds = bench.Bulk_Time();
+	results.BulkKBPerSecond = bench.Bulk_Rate();
+	results.Strings = bench.Strings();
+	results.StringMicroseconds = bench.String_Time();
+	results.StringNanoseconds = bench.String_Cost();
+
+	return results.Verified;
+}
+
+
 /**************************************************************************************************
 * Is_Legacy_Render_Enabled -- Is the legacy rendering enabled?
 *
@@ -2200,6 +2523,8 @@ void DLLExportClass::Init(void)
 
 	MessagesSent.clear();
 
+	Reset_Delta_State();
+
 	if (SpecialBackup == NULL) {
 		SpecialBackup = new SpecialClass;
 	}
@@ -2220,6 +2545,8 @@ void DLLExportClass::Init(void)
 **************************************************************************************************/
 void DLLExportClass::Shutdown(void)
 {
+	Finish_Background_Save();
+
 	delete SpecialBackup;
 	SpecialBackup = NULL;
 
@@ -2227,6 +2554,32 @@ void DLLExportClass::Shutdown(void)
 		delete [] ModSearchPaths[i];
 	}
 	ModSearchPaths.Clear();
+
+	Reset_Delta_State();
+	std::vector<unsigned char>().swap(LayerScratch);
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Reset_Delta_State -- Forget what has been sent to the clients by the delta exports
+*
+* In:   
+*
+* Out:  
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+void DLLExportClass::Reset_Delta_State(void)
+{
+	LayerBaselines.clear();
+	DynamicMapBaselines.clear();
+	for (int house = 0; house < HOUSE_COUNT; house++) {
+		ShroudBaselines[house].Frame = 0;
+	}
 }
 
 
@@ -3157,6 +3510,12 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Get_Game_State(GameStateReques
 			break;
 		}		 
 
+		case GAME_STATE_LAYERS_DELTA:
+		{
+			got_state = DLLExportClass::Get_Layer_Delta_State(player_id, buffer_in, buffer_size);
+			break;
+		}
+
 		case GAME_STATE_SIDEBAR:
 		{	
 			got_state = DLLExportClass::Get_Sidebar_State(player_id, buffer_in, buffer_size);
@@ -3177,6 +3536,26 @@ extern "C" __declspec(dllexport) bool __cdecl CNC_Get_Game_State(GameStateReques
 			got_state = DLLExportClass::Get_Shroud_State(player_id, buffer_in, buffer_size);
 			break;
 
+		case GAME_STATE_DYNAMIC_MAP_DELTA:
+		{
+			got_state = DLLExportClass::Get_Dynamic_Map_Delta_State(player_id, buffer_in, buffer_size);
+			break;
+		}
+
+		case GAME_STATE_SHROUD_DELTA:
+		{
+			got_state = DLLExportClass::Get_Shroud_Delta_State(player_id, buffer_in, buffer_size);
+			break;
+		}
+
+		case GAME_STATE_PROFILE:
+			got_state = DLLExportClass::Get_Profile_State(buffer_in, buffer_size);
+			break;
+
+		case GAME_STATE_SHAPE_CACHE:
+			got_state = DLLExportClass::Get_Shape_Cache_State(buffer_in, buffer_size);
+			break;
+
 		case GAME_STATE_OCCUPIER:
 			got_state = DLLExportClass::Get_Occupier_State(player_id, buffer_in, buffer_size);
 			break;
@@ -3715,59 +4094,261 @@ bool DLLExportClass::Get_Layer_State(uint64 player_id, unsigned char *buffer_in,
 
 	static int _export_count = 0;
 
-	bool got_state = false;
+	if (!Export_Layers(buffer_in, buffer_size, NULL)) {
+		return false;
+	}
 
-	ObjectList = (CNCObjectListStruct*) buffer_in;
+	if (ObjectList->Count) {
+		_export_count++;
+		return true;
+	}
 
-	TotalObjectCount = 0;
+	return false;
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Get_Layer_Delta_State -- Get the changes to the game objects since the client's last state
+*
+* In:   Player perspective
+*       Buffer to contain the changes. BaseFrame must hold the last Frame the client applied, or zero
+*       Size of buffer
+*
+* Out:  False if the buffer is too small
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+bool DLLExportClass::Get_Layer_Delta_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size)
+{
+	typedef std::map<const void *, std::vector<CNCObjectStruct> > ObjectRecordMap;
+
+	static const unsigned int _max_scratch_size = 64 * 1024 * 1024;
+
+	if (buffer_size < sizeof(CNCObjectDeltaStruct)) {
+		return false;
+	}
 
 	/*
-	** Get a reference draw coordinate for cells
+	** Build the complete object list into scratch memory first, growing it until everything fits
 	*/
-	int map_cell_x = Map.MapCellX;
-	int map_cell_y = Map.MapCellY;
-	if (map_cell_x > 0) {
-		map_cell_x--;
-	}
-	if (map_cell_y > 0) {
-		map_cell_y--;
+	std::vector<std::pair<const void *, int> > groups;
+	unsigned int scratch_size = max((unsigned int)LayerScratch.size(), (unsigned int)(sizeof(CNCObjectListStruct) + (256 * sizeof(CNCObjectStruct))));
+	for (;;) {
+		LayerScratch.resize(scratch_size);
+		groups.clear();
+		if (Export_Layers(&LayerScratch[0], scratch_size, &groups)) {
+			break;
+		}
+		if (scratch_size >= _max_scratch_size) {
+			return false;
+		}
+		scratch_size *= 2;
 	}
 
-	SortOrder = 0;
-
 	/*
-	**	Get the ground layer first and then followed by all the layers in increasing altitude.
+	** Compare against what the client has. If the client's frame isn't the one on record, start from nothing
 	*/
-	for (int layer = 0; layer < DLL_LAYER_COUNT; layer++) {
-		
-		ExportLayer = layer;
-		
-		for (int index = 0; index < Map.Layer[layer].Count(); index++) {
-			
-			ObjectClass *object = Map.Layer[layer][index];
-			if (object->IsActive) {
-				
-				unsigned int memory_needed = sizeof(CNCObjectListStruct);
-				memory_needed += (TotalObjectCount + 10) * sizeof(CNCObjectStruct);
-				if (memory_needed >= buffer_size) {
-					return false;
-				}
-				
-				if (object->Is_Techno()) {
-					/*
-					**  Skip units tethered to buildings, since the building will draw them itself
-					*/
-					TechnoClass* techno_object = static_cast<TechnoClass*>(object);
-					TechnoClass* contact_object = techno_object->In_Radio_Contact() ? techno_object->Contact_With_Whom() : nullptr;
-					if ((object->What_Am_I() != RTTI_BUILDING) && (contact_object != nullptr) && (contact_object->What_Am_I() == RTTI_BUILDING) && contact_object->IsTethered && *((BuildingClass*)contact_object) == STRUCT_WEAP) {
-						continue;
-					}
+	CNCObjectDeltaStruct *delta = (CNCObjectDeltaStruct *)buffer_in;
+	LayerBaselineStruct &baseline = LayerBaselines[player_id];
+	bool has_base = (delta->BaseFrame != 0) && (delta->BaseFrame == baseline.Frame);
 
-					/*
-					**  Skip units tethered to vessels, since the vessel will draw them itself
-					*/
-					if ((contact_object != nullptr) && (contact_object->What_Am_I() == RTTI_VESSEL) && !contact_object->Is_Door_Closed() && contact_object->IsTethered && !techno_object->IsInLimbo) {
-						continue;
+	ObjectRecordMap empty;
+	const ObjectRecordMap &previous = has_base ? baseline.Objects : empty;
+	ObjectRecordMap current;
+
+	unsigned char *out = delta->Changes;
+	unsigned char *out_end = buffer_in + buffer_size;
+	int change_count = 0;
+	int start = 0;
+
+	for (unsigned int g = 0; g < groups.size(); g++) {
+		const void *root = groups[g].first;
+		const CNCObjectStruct *records = &ObjectList->Objects[start];
+		int record_count = groups[g].second - start;
+		unsigned int bytes = record_count * sizeof(CNCObjectStruct);
+		start = groups[g].second;
+
+		current[root].assign(records, records + record_count);
+
+		CNCObjectChangeStruct change;
+		change.CNCInternalObjectPointer = (void *)root;
+		change.RecordCount = (unsigned short)record_count;
+
+		if (out + sizeof(change) > out_end) {
+			return false;
+		}
+		unsigned char *change_out = out;
+		unsigned char *data_out = out + sizeof(change);
+
+		ObjectRecordMap::const_iterator old = previous.find(root);
+		bool patched = false;
+		if ((old != previous.end()) && (old->second.size() == (unsigned int)record_count) && (bytes <= 0xffff)) {
+			const unsigned char *old_bytes = (const unsigned char *)&old->second[0];
+			const unsigned char *new_bytes = (const unsigned char *)records;
+			if (memcmp(old_bytes, new_bytes, bytes) == 0) {
+				continue;
+			}
+
+			/*
+			** Emit runs of changed bytes. Runs separated by less than a patch header are merged
+			*/
+			unsigned char *patch_out = data_out;
+			unsigned int index = 0;
+			patched = true;
+			while (index < bytes) {
+				if (old_bytes[index] == new_bytes[index]) {
+					index++;
+					continue;
+				}
+				unsigned int run_start = index;
+				unsigned int run_end = index + 1;
+				for (unsigned int scan = run_end; scan < bytes && scan < run_end + sizeof(CNCObjectPatchStruct); scan++) {
+					if (old_bytes[scan] != new_bytes[scan]) {
+						run_end = scan + 1;
+					}
+				}
+				if (patch_out + sizeof(CNCObjectPatchStruct) + (run_end - run_start) > out_end || (unsigned int)(patch_out - data_out) >= bytes) {
+					patched = false;
+					break;
+				}
+				CNCObjectPatchStruct patch;
+				patch.Offset = (unsigned short)run_start;
+				patch.Length = (unsigned short)(run_end - run_start);
+				memcpy(patch_out, &patch, sizeof(patch));
+				memcpy(patch_out + sizeof(patch), new_bytes + run_start, run_end - run_start);
+				patch_out += sizeof(patch) + (run_end - run_start);
+				index = run_end;
+			}
+
+			if (patched) {
+				change.Change = OBJECT_CHANGE_PATCH;
+				change.Size = (unsigned int)(patch_out - data_out);
+			}
+		}
+
+		/*
+		** New objects, objects whose record count changed, and patches that grew too big resend all the records
+		*/
+		if (!patched) {
+			if (data_out + bytes > out_end) {
+				return false;
+			}
+			memcpy(data_out, records, bytes);
+			change.Change = OBJECT_CHANGE_ADD;
+			change.Size = bytes;
+		}
+
+		memcpy(change_out, &change, sizeof(change));
+		out = data_out + change.Size;
+		change_count++;
+	}
+
+	for (ObjectRecordMap::const_iterator old = previous.begin(); old != previous.end(); ++old) {
+		if (current.find(old->first) == current.end()) {
+			if (out + sizeof(CNCObjectChangeStruct) > out_end) {
+				return false;
+			}
+			CNCObjectChangeStruct change;
+			change.CNCInternalObjectPointer = (void *)old->first;
+			change.Change = OBJECT_CHANGE_REMOVE;
+			change.RecordCount = 0;
+			change.Size = 0;
+			memcpy(out, &change, sizeof(change));
+			out += sizeof(change);
+			change_count++;
+		}
+	}
+
+	/*
+	** Everything fit, so this state becomes the one the client is expected to have
+	*/
+	if (++LayerDeltaFrame == 0) {
+		LayerDeltaFrame = 1;
+	}
+	delta->BaseFrame = has_base ? baseline.Frame : 0;
+	delta->Frame = LayerDeltaFrame;
+	delta->Count = change_count;
+	delta->Size = (unsigned int)(out - delta->Changes);
+
+	baseline.Frame = LayerDeltaFrame;
+	baseline.Objects.swap(current);
+
+	return true;
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Export_Layers -- Fill an object list with the game objects from the layers
+*
+* In:   Buffer to contain the object list
+*       Size of buffer
+*       Optional list to receive each root object and the end index of its records
+*
+* Out:  False if the buffer is too small
+*
+*
+*
+* History: 1/29/2019 11:37AM - ST
+**************************************************************************************************/
+bool DLLExportClass::Export_Layers(unsigned char *buffer_in, unsigned int buffer_size, std::vector<std::pair<const void *, int> > *groups)
+{
+	ObjectList = (CNCObjectListStruct*) buffer_in;
+
+	TotalObjectCount = 0;
+
+	/*
+	** Get a reference draw coordinate for cells
+	*/
+	int map_cell_x = Map.MapCellX;
+	int map_cell_y = Map.MapCellY;
+	if (map_cell_x > 0) {
+		map_cell_x--;
+	}
+	if (map_cell_y > 0) {
+		map_cell_y--;
+	}
+
+	SortOrder = 0;
+
+	/*
+	**	Get the ground layer first and then followed by all the layers in increasing altitude.
+	*/
+	for (int layer = 0; layer < DLL_LAYER_COUNT; layer++) {
+		
+		ExportLayer = layer;
+		
+		for (int index = 0; index < Map.Layer[layer].Count(); index++) {
+			
+			ObjectClass *object = Map.Layer[layer][index];
+			if (object->IsActive) {
+				
+				unsigned int memory_needed = sizeof(CNCObjectListStruct);
+				memory_needed += (TotalObjectCount + 10) * sizeof(CNCObjectStruct);
+				if (memory_needed >= buffer_size) {
+					return false;
+				}
+				
+				if (object->Is_Techno()) {
+					/*
+					**  Skip units tethered to buildings, since the building will draw them itself
+					*/
+					TechnoClass* techno_object = static_cast<TechnoClass*>(object);
+					TechnoClass* contact_object = techno_object->In_Radio_Contact() ? techno_object->Contact_With_Whom() : nullptr;
+					if ((object->What_Am_I() != RTTI_BUILDING) && (contact_object != nullptr) && (contact_object->What_Am_I() == RTTI_BUILDING) && contact_object->IsTethered && *((BuildingClass*)contact_object) == STRUCT_WEAP) {
+						continue;
+					}
+
+					/*
+					**  Skip units tethered to vessels, since the vessel will draw them itself
+					*/
+					if ((contact_object != nullptr) && (contact_object->What_Am_I() == RTTI_VESSEL) && !contact_object->Is_Door_Closed() && contact_object->IsTethered && !techno_object->IsInLimbo) {
+						continue;
 					}
 				}
 
@@ -3842,6 +4423,10 @@ bool DLLExportClass::Get_Layer_State(uint64 player_id, unsigned char *buffer_in,
 					}
 
 					TotalObjectCount += CurrentDrawCount;
+
+					if ((groups != NULL) && (CurrentDrawCount > 0)) {
+						groups->push_back(std::make_pair((const void *)object, TotalObjectCount));
+					}
 				}
 			}
 		}
@@ -3849,12 +4434,7 @@ bool DLLExportClass::Get_Layer_State(uint64 player_id, unsigned char *buffer_in,
 
 	ObjectList->Count = TotalObjectCount;
 
-	if (ObjectList->Count) {
-		_export_count++;
-		return true;
-	}
-
-	return false;
+	return true;
 }
 
 
@@ -6075,16 +6655,7 @@ bool DLLExportClass::Get_Shroud_State(uint64 player_id, unsigned char *buffer_in
 	*/
 	static unsigned int _shroud_bits[UNIT_MAX];
 
-	if (GAME_TO_PLAY == GAME_GLYPHX_MULTIPLAYER) {
-		for (int index = 0; index < Units.Count(); index++) {
-			UnitClass * obj = Units.Ptr(index);
-			if (obj->Class->IsGapper && obj->IsActive && obj->Strength) {
-				if (!obj->House->Is_Ally(PlayerPtr)) {
-					_shroud_bits[index] = obj->Apply_Temporary_Jamming_Shroud(PlayerPtr);
-				}
-			}
-		}
-	}
+	Apply_Gap_Shroud(_shroud_bits);
 
 	CNCShroudStruct *shroud = (CNCShroudStruct*) buffer_in;
 	
@@ -6131,47 +6702,431 @@ bool DLLExportClass::Get_Shroud_State(uint64 player_id, unsigned char *buffer_in
 				return false;
 			}
 
-			int xpixel;
-			int ypixel;
+			Fill_Shroud_Entry(Coord_Cell(coord), shroud->Entries[entry_index]);
 
-			Map.Coord_To_Pixel(coord, xpixel, ypixel);
+			entry_index++;
+		}
+	}
 
-			CellClass * cellptr = &Map[Coord_Cell(coord)];
+	shroud->Count = entry_index;
 
-			CNCShroudEntryStruct &shroud_entry = shroud->Entries[entry_index];
+	Unapply_Gap_Shroud(_shroud_bits);
+	
+	return true;
+}	
 
-			shroud_entry.IsVisible = cellptr->Is_Visible(PlayerPtr);
-			shroud_entry.IsMapped = cellptr->Is_Mapped(PlayerPtr);
-			shroud_entry.IsJamming = cellptr->Is_Jamming(PlayerPtr);
-			//shroud_entry.IsVisible = cellptr->IsVisible;
-			//shroud_entry.IsMapped = cellptr->IsMapped;
-			shroud_entry.ShadowIndex = -1;
 
-			if (shroud_entry.IsMapped) {
-				if (!shroud_entry.IsVisible) {
-					shroud_entry.ShadowIndex = (char)Map.Cell_Shadow(cell, PlayerPtr);
-				}
+
+
+/**************************************************************************************************
+* CellRunWriterClass -- Writes runs of changed cells into a CNCCellDeltaStruct
+*
+* History: 10/17/2026
+**************************************************************************************************/
+class CellRunWriterClass {
+	public:
+		CellRunWriterClass(CNCCellDeltaStruct *delta, unsigned char *buffer_end) :
+			Delta(delta),
+			Out(delta->Runs),
+			End(buffer_end),
+			Run(NULL),
+			LastIndex(-1)
+		{
+			Delta->RunCount = 0;
+		}
+
+		/*
+		** Add a cell to the current run (or start a new one). Returns where the cell's entries go, or NULL if there
+		** isn't room for the given number of entry bytes
+		*/
+		unsigned char *Add_Cell(int index, unsigned int entry_bytes)
+		{
+			bool new_run = (Run == NULL) || (index != LastIndex + 1) || (Run->Count == 0xFFFF);
+			unsigned int needed = entry_bytes + (new_run ? sizeof(CNCCellRunStruct) : 0);
+			if ((unsigned int)(End - Out) < needed) {
+				return NULL;
 			}
+			if (new_run) {
+				Run = (CNCCellRunStruct *)Out;
+				Run->Start = (unsigned short)index;
+				Run->Count = 0;
+				Run->EntryCount = 0;
+				Out += sizeof(CNCCellRunStruct);
+				Delta->RunCount++;
+			}
+			Run->Count++;
+			LastIndex = index;
+			return Out;
+		}
 
-			entry_index++;
+		void Add_Entries(int count, unsigned int bytes)
+		{
+			Run->EntryCount += count;
+			Out += bytes;
 		}
+
+		unsigned int Size(void) const {return (unsigned int)(Out - Delta->Runs);}
+
+	private:
+		CNCCellDeltaStruct *Delta;
+		unsigned char *Out;
+		unsigned char *End;
+		CNCCellRunStruct *Run;
+		int LastIndex;
+};
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Get_Cell_Export_Rect -- Get the map rectangle covered by the per-cell exports
+*
+* In:   
+*
+* Out:  Cell rectangle, one cell larger than the visible map on each side where possible
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+void DLLExportClass::Get_Cell_Export_Rect(int &map_cell_x, int &map_cell_y, int &map_cell_width, int &map_cell_height)
+{
+	map_cell_x = Map.MapCellX;
+	map_cell_y = Map.MapCellY;
+	map_cell_width = Map.MapCellWidth;
+	map_cell_height = Map.MapCellHeight;
+
+	if (map_cell_x > 0) {
+		map_cell_x--;
+		map_cell_width++;
 	}
 
-	shroud->Count = entry_index;
+	if (map_cell_width < MAP_MAX_CELL_WIDTH) {
+		map_cell_width++;
+	}
 
+	if (map_cell_y > 0) {
+		map_cell_y--;
+		map_cell_height++;
+	}
+
+	if (map_cell_height < MAP_MAX_CELL_HEIGHT) {
+		map_cell_height++;
+	}
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Apply_Gap_Shroud -- Apply the mobile gap generator shroud for the current player
+*
+* In:   Array to receive the cells shrouded by each unit
+*
+* Out:  
+*
+*
+*
+* History: 4/12/2019 3:44PM - ST
+**************************************************************************************************/
+void DLLExportClass::Apply_Gap_Shroud(unsigned int *shroud_bits)
+{
 	if (GAME_TO_PLAY == GAME_GLYPHX_MULTIPLAYER) {
 		for (int index = 0; index < Units.Count(); index++) {
 			UnitClass * obj = Units.Ptr(index);
 			if (obj->Class->IsGapper && obj->IsActive && obj->Strength) {
 				if (!obj->House->Is_Ally(PlayerPtr)) {
-					obj->Unapply_Temporary_Jamming_Shroud(PlayerPtr, _shroud_bits[index]);
+					shroud_bits[index] = obj->Apply_Temporary_Jamming_Shroud(PlayerPtr);
 				}
 			}
 		}
 	}
-	
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Unapply_Gap_Shroud -- Remove the shroud added by Apply_Gap_Shroud
+*
+* In:   Cells shrouded by each unit
+*
+* Out:  
+*
+*
+*
+* History: 4/12/2019 3:44PM - ST
+**************************************************************************************************/
+void DLLExportClass::Unapply_Gap_Shroud(unsigned int const *shroud_bits)
+{
+	if (GAME_TO_PLAY == GAME_GLYPHX_MULTIPLAYER) {
+		for (int index = 0; index < Units.Count(); index++) {
+			UnitClass * obj = Units.Ptr(index);
+			if (obj->Class->IsGapper && obj->IsActive && obj->Strength) {
+				if (!obj->House->Is_Ally(PlayerPtr)) {
+					obj->Unapply_Temporary_Jamming_Shroud(PlayerPtr, shroud_bits[index]);
+				}
+			}
+		}
+	}
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Fill_Shroud_Entry -- Get the shroud state of a cell for the current player
+*
+* In:   Cell
+*       Entry to fill in
+*
+* Out:  
+*
+*
+*
+* History: 4/12/2019 3:44PM - ST
+**************************************************************************************************/
+void DLLExportClass::Fill_Shroud_Entry(CELL cell, CNCShroudEntryStruct &shroud_entry)
+{
+	CellClass * cellptr = &Map[cell];
+
+	shroud_entry.IsVisible = cellptr->Is_Visible(PlayerPtr);
+	shroud_entry.IsMapped = cellptr->Is_Mapped(PlayerPtr);
+	shroud_entry.IsJamming = cellptr->Is_Jamming(PlayerPtr);
+	//shroud_entry.IsVisible = cellptr->IsVisible;
+	//shroud_entry.IsMapped = cellptr->IsMapped;
+	shroud_entry.ShadowIndex = -1;
+
+	if (shroud_entry.IsMapped) {
+		if (!shroud_entry.IsVisible) {
+			shroud_entry.ShadowIndex = (char)Map.Cell_Shadow(cell, PlayerPtr);
+		}
+	}
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::On_Shroud_Changed -- Flag a cell's shroud to be resent by the delta export
+*
+* In:   Cell whose visible, mapped or jamming state changed
+*       Bit field of the houses it changed for
+*
+* Out:  
+*
+*  The shadow of a shrouded cell depends on its neighbors, so they are flagged as well
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+void DLLExportClass::On_Shroud_Changed(CELL cell, unsigned int houses)
+{
+	int cell_x = Cell_X(cell);
+	int cell_y = Cell_Y(cell);
+
+	for (int y = cell_y - 1; y <= cell_y + 1; y++) {
+		for (int x = cell_x - 1; x <= cell_x + 1; x++) {
+			if ((unsigned)x < MAP_CELL_W && (unsigned)y < MAP_CELL_H) {
+				ShroudDirty[XY_Cell(x, y)] |= houses;
+			}
+		}
+	}
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Get_Shroud_Delta_State -- Get the shroud cells that changed since the client's last state
+*
+* In:   Player perspective
+*       Buffer to contain the changes. BaseFrame must hold the last Frame the client applied, or zero
+*       Size of buffer
+*
+* Out:  False if the buffer is too small
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+bool DLLExportClass::Get_Shroud_Delta_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size)
+{
+	if (!DLLExportClass::Set_Player_Context(player_id)) {
+		return false;
+	}
+
+	if (buffer_size < sizeof(CNCCellDeltaStruct)) {
+		return false;
+	}
+
+	CNCCellDeltaStruct *delta = (CNCCellDeltaStruct *) buffer_in;
+	unsigned int house_bit = 1 << PlayerPtr->Class->House;
+	CellBaselineStruct &baseline = ShroudBaselines[PlayerPtr->Class->House];
+
+	int map_cell_x, map_cell_y, map_cell_width, map_cell_height;
+	Get_Cell_Export_Rect(map_cell_x, map_cell_y, map_cell_width, map_cell_height);
+
+	bool has_base = (delta->BaseFrame != 0) && (delta->BaseFrame == baseline.Frame) &&
+						 (baseline.MapCellX == map_cell_x) && (baseline.MapCellY == map_cell_y) &&
+						 (baseline.MapCellWidth == map_cell_width) && (baseline.MapCellHeight == map_cell_height);
+
+	/*
+	** Apply mobile gap generators. This flags the cells they cover, so they are sent along with everything else
+	*/
+	static unsigned int _shroud_bits[UNIT_MAX];
+
+	Apply_Gap_Shroud(_shroud_bits);
+
+	CellRunWriterClass writer(delta, buffer_in + buffer_size);
+	bool fits = true;
+
+	for (int y = 0; y < map_cell_height && fits; y++) {
+		for (int x = 0; x < map_cell_width; x++) {
+			CELL cell = XY_Cell(map_cell_x + x, map_cell_y + y);
+			if (has_base && !(ShroudDirty[cell] & house_bit)) {
+				continue;
+			}
+
+			unsigned char *entry_out = writer.Add_Cell((y * map_cell_width) + x, sizeof(CNCShroudEntryStruct));
+			if (entry_out == NULL) {
+				fits = false;
+				break;
+			}
+
+			CNCShroudEntryStruct shroud_entry;
+			Fill_Shroud_Entry(cell, shroud_entry);
+			memcpy(entry_out, &shroud_entry, sizeof(shroud_entry));
+			writer.Add_Entries(1, sizeof(shroud_entry));
+		}
+	}
+
+	/*
+	** The client now has every cell, so the flags can be cleared. This must happen before the gap generator
+	** shroud is removed again, so that the cells it restores get sent next time
+	*/
+	if (fits) {
+		for (int y = 0; y < map_cell_height; y++) {
+			for (int x = 0; x < map_cell_width; x++) {
+				ShroudDirty[XY_Cell(map_cell_x + x, map_cell_y + y)] &= ~house_bit;
+			}
+		}
+
+		if (++CellDeltaFrame == 0) {
+			CellDeltaFrame = 1;
+		}
+		delta->BaseFrame = has_base ? baseline.Frame : 0;
+		delta->Frame = CellDeltaFrame;
+		delta->MapCellX = map_cell_x;
+		delta->MapCellY = map_cell_y;
+		delta->MapCellWidth = map_cell_width;
+		delta->MapCellHeight = map_cell_height;
+		delta->Size = writer.Size();
+
+		baseline.Frame = CellDeltaFrame;
+		baseline.MapCellX = map_cell_x;
+		baseline.MapCellY = map_cell_y;
+		baseline.MapCellWidth = map_cell_width;
+		baseline.MapCellHeight = map_cell_height;
+	}
+
+	Unapply_Gap_Shroud(_shroud_bits);
+
+	return fits;
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Get_Profile_State -- Get the frame profiler timings
+*
+* In:   Buffer to contain the timings
+*       Size of buffer
+*
+* Out:  False if the buffer is too small
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+bool DLLExportClass::Get_Profile_State(unsigned char *buffer_in, unsigned int buffer_size)
+{
+	if (buffer_size < sizeof(CNCProfileStruct)) {
+		return false;
+	}
+
+	CNCProfileStruct *profile = (CNCProfileStruct *)buffer_in;
+	memset(profile, 0, sizeof(CNCProfileStruct));
+
+	profile->Enabled = Profiler.Is_Enabled();
+	profile->Frames = Profiler.Frame_Count();
+	profile->Count = min((int)BENCH_COUNT, MAX_PROFILE_ENTRIES);
+
+	for (int index = 0; index < profile->Count; index++) {
+		BenchType bench = (BenchType)index;
+		CNCProfileEntryStruct &entry = profile->Entries[index];
+
+		strncpy(entry.Name, ProfilerClass::Name(bench), sizeof(entry.Name) - 1);
+		entry.Calls = Profiler.Total_Calls(bench);
+		entry.TotalMicroseconds = Profiler.Total_Time(bench);
+		entry.LastFrameCalls = Profiler.Frame_Calls(bench);
+		entry.LastFrameMicroseconds = Profiler.Frame_Time(bench);
+		entry.MaxFrameMicroseconds = Profiler.Max_Frame_Time(bench);
+		for (int bucket = 0; bucket < min(PROFILE_BUCKETS, PROFILE_HISTOGRAM_BUCKETS); bucket++) {
+			entry.Histogram[bucket] = Profiler.Histogram(bench, bucket);
+		}
+	}
+
 	return true;
-}	
+}
+
+
+
+
+/**************************************************************************************************
+* DLLExportClass::Get_Shape_Cache_State -- Get the usage of the uncompressed shape caches
+*
+* In:   Buffer to contain the cache state
+*       Size of buffer
+*
+* Out:  False if the buffer is too small
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+bool DLLExportClass::Get_Shape_Cache_State(unsigned char *buffer_in, unsigned int buffer_size)
+{
+	if (buffer_size < sizeof(CNCShapeCacheStruct)) {
+		return false;
+	}
+
+	CNCShapeCacheStruct *state = (CNCShapeCacheStruct *)buffer_in;
+	memset(state, 0, sizeof(CNCShapeCacheStruct));
+
+	ShapeCacheClass *caches[2] = {&BigShapeCache, &TheaterShapeCache};
+	CNCShapeCacheEntryStruct *entries[2] = {&state->Units, &state->Theater};
+
+	for (int index = 0; index < 2; index++) {
+		ShapeCacheClass &cache = *caches[index];
+		CNCShapeCacheEntryStruct &entry = *entries[index];
+
+		entry.Budget = cache.Budget();
+		entry.Size = cache.Size();
+		entry.Used = cache.Used();
+		entry.Frames = cache.Frames();
+		entry.Hits = cache.Hits();
+		entry.Misses = cache.Misses();
+		entry.Evictions = cache.Evictions();
+		entry.Compactions = cache.Compactions();
+	}
+
+	state->PredecodeFrames = PredecodeFrames;
+	state->PredecodeMicroseconds = PredecodeTime;
+
+	return true;
+}
 
 
 
@@ -6525,6 +7480,130 @@ bool DLLExportClass::Get_Dynamic_Map_State(uint64 player_id, unsigned char *buff
 
 
 
+/**************************************************************************************************
+* DLLExportClass::Get_Dynamic_Map_Delta_State -- Get the smudge and overlay cells that changed since the client's last state
+*
+* In:   Player perspective
+*       Buffer to contain the changes. Cells.BaseFrame must hold the last Frame the client applied, or zero
+*       Size of buffer
+*
+* Out:  False if the buffer is too small
+*
+*
+*
+* History: 10/17/2026
+**************************************************************************************************/
+bool DLLExportClass::Get_Dynamic_Map_Delta_State(uint64 player_id, unsigned char *buffer_in, unsigned int buffer_size)
+{
+	/*
+	** Most cells can produce a smudge, an overlay and a flag
+	*/
+	static const int _max_cell_entries = 4;
+	static unsigned char _cell_entries[sizeof(CNCDynamicMapStruct) + (_max_cell_entries * sizeof(CNCDynamicMapEntryStruct))];
+
+	if (buffer_size < sizeof(CNCDynamicMapDeltaStruct)) {
+		return false;
+	}
+
+	CNCDynamicMapDeltaStruct *dynamic_map = (CNCDynamicMapDeltaStruct *) buffer_in;
+	CNCCellDeltaStruct *delta = &dynamic_map->Cells;
+	CellBaselineStruct &baseline = DynamicMapBaselines[player_id];
+
+	int map_cell_x, map_cell_y, map_cell_width, map_cell_height;
+	Get_Cell_Export_Rect(map_cell_x, map_cell_y, map_cell_width, map_cell_height);
+
+	// Need to ignore view constraints for dynamic map updates, so the radar map
+	// has the latest tiberium state for cells outside the tactical view
+	DLLExportClass::Adjust_Internal_View(true);
+
+	/*
+	** Entry positions are relative to the tactical view, so if it moved everything has to be sent
+	*/
+	int cell_count = map_cell_width * map_cell_height;
+	bool has_base = (delta->BaseFrame != 0) && (delta->BaseFrame == baseline.Frame) &&
+						 (baseline.MapCellX == map_cell_x) && (baseline.MapCellY == map_cell_y) &&
+						 (baseline.MapCellWidth == map_cell_width) && (baseline.MapCellHeight == map_cell_height) &&
+						 (baseline.TacticalCoord == Map.TacticalCoord) && (baseline.Keys.size() == (unsigned int)cell_count);
+
+	std::vector<unsigned __int64> keys(cell_count);
+	CNCDynamicMapStruct *cell_map = (CNCDynamicMapStruct *) _cell_entries;
+
+	CellRunWriterClass writer(delta, buffer_in + buffer_size);
+
+	for (int y = 0 ; y < map_cell_height ; y++) {
+		for (int x = 0 ; x < map_cell_width ; x++) {
+			CELL cell = XY_Cell(map_cell_x+x, map_cell_y+y);
+			COORDINATE coord = Cell_Coord(cell) & 0xFF00FF00L;
+			CellClass * cellptr = &Map[Coord_Cell(coord)];
+			int index = (y * map_cell_width) + x;
+
+			/*
+			** The key holds everything Cell_Class_Draw_It looks at. Flags animate, so they are always sent
+			*/
+			int xpixel;
+			int ypixel;
+			bool drawn = Map.Coord_To_Pixel(coord, xpixel, ypixel) && (GAME_TO_PLAY == GAME_GLYPHX_MULTIPLAYER || cellptr->IsMapped || Debug_Unshroud);
+			unsigned __int64 key = 0;
+			if (drawn) {
+				key = (unsigned __int64)(unsigned char)cellptr->Smudge |
+						((unsigned __int64)cellptr->SmudgeData << 8) |
+						((unsigned __int64)(unsigned char)cellptr->Overlay << 16) |
+						((unsigned __int64)cellptr->OverlayData << 24) |
+						((unsigned __int64)(unsigned char)cellptr->Owner << 32) |
+						((unsigned __int64)1 << 40);
+			}
+			keys[index] = key;
+
+			if (has_base && (key == baseline.Keys[index]) && !(drawn && cellptr->IsFlagged)) {
+				continue;
+			}
+
+			int entry_count = 0;
+			if (drawn) {
+				Cell_Class_Draw_It(cell_map, entry_count, cellptr, xpixel, ypixel, false);
+			}
+
+			unsigned int entry_bytes = entry_count * sizeof(CNCDynamicMapEntryStruct);
+			unsigned char *entry_out = writer.Add_Cell(index, entry_bytes);
+			if (entry_out == NULL) {
+				return false;
+			}
+			memcpy(entry_out, cell_map->Entries, entry_bytes);
+			writer.Add_Entries(entry_count, entry_bytes);
+		}
+	}
+
+	dynamic_map->VortexActive = ChronalVortex.Is_Active();
+	dynamic_map->VortexX = Coord_X(ChronalVortex.Get_Position());
+	dynamic_map->VortexY = Coord_Y(ChronalVortex.Get_Position());
+	dynamic_map->VortexWidth = Pixel_To_Lepton(64);
+	dynamic_map->VortexHeight = Pixel_To_Lepton(64);
+
+	if (++CellDeltaFrame == 0) {
+		CellDeltaFrame = 1;
+	}
+	delta->BaseFrame = has_base ? baseline.Frame : 0;
+	delta->Frame = CellDeltaFrame;
+	delta->MapCellX = map_cell_x;
+	delta->MapCellY = map_cell_y;
+	delta->MapCellWidth = map_cell_width;
+	delta->MapCellHeight = map_cell_height;
+	delta->Size = writer.Size();
+
+	baseline.Frame = CellDeltaFrame;
+	baseline.MapCellX = map_cell_x;
+	baseline.MapCellY = map_cell_y;
+	baseline.MapCellWidth = map_cell_width;
+	baseline.MapCellHeight = map_cell_height;
+	baseline.TacticalCoord = Map.TacticalCoord;
+	baseline.Keys.swap(keys);
+
+	return true;
+}
+
+
+
+
 /**************************************************************************************************
 * DLLExportClass::Cell_Class_Draw_It -- Go through the motions of drawing a cell to get the smudge and overlay info
 *
@@ -8690,6 +9769,8 @@ bool DLLExportClass::Load(Straw & file)
 {
 	unsigned int version = 0;
 
+	Reset_Delta_State();
+
 	if (file.Get(&version, sizeof(version)) != sizeof(version)) {
 		return false;
 	}
@@ -73,7 +73,12 @@ enum GameStateRequestEnum {
 	GAME_STATE_PLACEMENT,
 	GAME_STATE_SHROUD,
 	GAME_STATE_OCCUPIER,
-	GAME_STATE_PLAYER_INFO
+	GAME_STATE_PLAYER_INFO,
+	GAME_STATE_LAYERS_DELTA,
+	GAME_STATE_SHROUD_DELTA,
+	GAME_STATE_DYNAMIC_MAP_DELTA,
+	GAME_STATE_PROFILE,
+	GAME_STATE_SHAPE_CACHE
 };	
 
 
@@ -294,6 +299,52 @@ struct CNCObjectListStruct {
 
 
 
+/**************************************************************************************
+** 
+**  Object state delta data
+** 
+**  Used by GAME_STATE_LAYERS_DELTA to pass back only the objects that have changed since the last state the
+**  client received. Before the call, the client puts the Frame value of the last delta it applied into BaseFrame
+**  (or zero if it has none). If the DLL still has that state on record, the changes are relative to it. Otherwise
+**  BaseFrame comes back as zero and the changes are relative to an empty object list.
+**
+**  Each change is a CNCObjectChangeStruct followed by Size bytes of data. The records for an object are the same
+**  CNCObjectStruct records (base object plus sub objects) that GAME_STATE_LAYERS would return for it.
+**    OBJECT_CHANGE_ADD      - Data is RecordCount complete CNCObjectStruct records. Replaces any records the client
+**                             already has for the object.
+**    OBJECT_CHANGE_PATCH    - Same number of records as before. Data is a list of CNCObjectPatchStruct, each followed
+**                             by Length bytes to copy over the old records starting at Offset.
+**    OBJECT_CHANGE_REMOVE   - No data. The object is no longer exported.
+*/
+enum CNCObjectChangeEnum : unsigned char {
+	OBJECT_CHANGE_ADD,
+	OBJECT_CHANGE_PATCH,
+	OBJECT_CHANGE_REMOVE
+};
+
+struct CNCObjectChangeStruct {
+	void					*CNCInternalObjectPointer;		// Root object the records belong to
+	CNCObjectChangeEnum	Change;
+	unsigned short		RecordCount;
+	unsigned int		Size;
+};
+
+struct CNCObjectPatchStruct {
+	unsigned short		Offset;
+	unsigned short		Length;
+};
+
+struct CNCObjectDeltaStruct {
+	unsigned int		BaseFrame;
+	unsigned int		Frame;
+	int					Count;
+	unsigned int		Size;
+	unsigned char		Changes[1];		// Variable length
+};
+
+
+
+
 /**************************************************************************************
 ** 
 **  Placement validity data
@@ -761,6 +812,7 @@ struct CNCMultiplayerOptionsStruct {
 	bool CaptureTheFlag;
 	bool DestroyStructures;				// New early win condition via destroying all a player's structures
 	bool ModernBalance;
+	bool ThreatPrescan;					// Threat scans are run ahead of the object AI across the worker threads
 };
 
 
@@ -881,6 +933,49 @@ struct CNCShroudStruct {
 
 
 
+/**************************************************************************************
+** 
+**  Changed cell data
+** 
+**  Used by GAME_STATE_SHROUD_DELTA and GAME_STATE_DYNAMIC_MAP_DELTA to pass back only the cells that have changed
+**  since the last state the client received. Before the call, the client puts the Frame value of the last state it
+**  applied into BaseFrame (or zero if it has none). If BaseFrame comes back as zero, every cell is included.
+**
+**  Cells are numbered across the map rectangle given in the header, in the same order as the full state requests.
+**  Changed cells are grouped into runs of consecutive cells. Each run is a CNCCellRunStruct followed by EntryCount
+**  entries (CNCShroudEntryStruct or CNCDynamicMapEntryStruct) that replace whatever the client had for those cells.
+*/
+struct CNCCellRunStruct {
+	unsigned short				Start;
+	unsigned short				Count;
+	int							EntryCount;
+};
+
+struct CNCCellDeltaStruct {
+	unsigned int				BaseFrame;
+	unsigned int				Frame;
+	int							MapCellX;
+	int							MapCellY;
+	int							MapCellWidth;
+	int							MapCellHeight;
+	int							RunCount;
+	unsigned int				Size;
+	unsigned char				Runs[1];				// Variable length
+};
+
+struct CNCDynamicMapDeltaStruct {
+	bool							VortexActive;
+	int							VortexX;
+	int							VortexY;
+	int							VortexWidth;
+	int							VortexHeight;
+	CNCCellDeltaStruct		Cells;				// Variable length
+};
+
+
+
+
+
 
 /**************************************************************************************
 **
@@ -906,6 +1001,139 @@ struct CNCOccupierHeaderStruct {
 
 
 
+/**************************************************************************************
+**
+**  Frame profile.
+**
+**  Used by GAME_STATE_PROFILE to pass back the timings gathered since profiling was turned on with
+**  CNC_Set_Profiler. There is one entry for each benchmarked section of the game code. Times are in
+**  microseconds. Histogram[N] counts the game frames in which the section took less than 2^N microseconds
+**  (and at least half that); the last bucket counts all longer frames.
+*/
+#define MAX_PROFILE_ENTRIES 32
+#define PROFILE_HISTOGRAM_BUCKETS 16
+
+struct CNCProfileEntryStruct {
+	char							Name[24];
+	unsigned int				Calls;
+	unsigned __int64			TotalMicroseconds;
+	unsigned int				LastFrameCalls;
+	unsigned int				LastFrameMicroseconds;
+	unsigned int				MaxFrameMicroseconds;
+	unsigned int				Histogram[PROFILE_HISTOGRAM_BUCKETS];
+};
+
+struct CNCProfileStruct {
+	bool							Enabled;
+	unsigned int				Frames;
+	int							Count;
+	CNCProfileEntryStruct	Entries[MAX_PROFILE_ENTRIES];
+};
+
+
+
+
+/**************************************************************************************
+**
+**  Uncompressed shape cache.
+**
+**  Used by GAME_STATE_SHAPE_CACHE to pass back the state of the caches that hold the uncompressed
+**  frames of the keyframe shapes. The budgets are set with CNC_Set_Shape_Cache_Budget. Sizes are in
+**  bytes. The counts are totals since the game library was loaded. The last two fields tell how many
+**  frames were uncompressed ahead of time when the current scenario was loaded, and how long it took.
+*/
+struct CNCShapeCacheEntryStruct {
+	unsigned int				Budget;
+	unsigned int				Size;
+	unsigned int				Used;
+	unsigned int				Frames;
+	unsigned int				Hits;
+	unsigned int				Misses;
+	unsigned int				Evictions;
+	unsigned int				Compactions;
+};
+
+struct CNCShapeCacheStruct {
+	CNCShapeCacheEntryStruct	Units;
+	CNCShapeCacheEntryStruct	Theater;
+	unsigned int				PredecodeFrames;
+	unsigned int				PredecodeMicroseconds;
+};
+
+
+
+
+/**************************************************************************************
+**
+**  Replay benchmark results.
+**
+**  Filled in by CNC_Run_Replay_Benchmark. Times are in microseconds. Complete is false if the playback was
+**  stopped by the frame limit before the game or the recording ended. RecentCRCs holds the game CRC logged
+**  at the start of each of the last frames played, oldest first, ending with frame FinalFrame. FinalCRC is
+**  the game CRC after the last frame.
+*/
+#define REPLAY_RECENT_CRCS 32
+
+struct CNCReplayBenchmarkStruct {
+	bool							Complete;
+	int							Frames;
+	unsigned __int64			TotalMicroseconds;
+	unsigned int				FramesPerSecond;
+	unsigned int				MedianFrameMicroseconds;
+	unsigned int				Percentile90FrameMicroseconds;
+	unsigned int				Percentile99FrameMicroseconds;
+	unsigned int				MaxFrameMicroseconds;
+	int							FinalFrame;
+	unsigned int				FinalCRC;
+	unsigned int				RecentCRCs[REPLAY_RECENT_CRCS];
+};
+
+
+
+
+/**************************************************************************************
+**
+**  LCW benchmark results.
+**
+**  Filled in by CNC_Run_LCW_Benchmark. RawBytes is the total size of the uncompressed samples and PackedBytes
+**  is their total size after compression. Times are in microseconds and rates are in kilobytes of uncompressed
+**  data per second. Verified is false if any sample did not decompress to exactly the original data.
+*/
+struct CNCLCWBenchmarkStruct {
+	bool							Verified;
+	int							Samples;
+	unsigned int				RawBytes;
+	unsigned int				PackedBytes;
+	unsigned __int64			CompressMicroseconds;
+	unsigned __int64			UncompressMicroseconds;
+	unsigned int				CompressKBPerSecond;
+	unsigned int				UncompressKBPerSecond;
+};
+
+
+
+
+/**************************************************************************************
+**
+**  CRC benchmark results.
+**
+**  Filled in by CNC_Run_CRC_Benchmark. The bulk test runs the CRC over BulkBytes of map data and the string
+**  test hashes Strings type and rule entry names. Times are the totals over all passes, in microseconds.
+**  Verified is false if any value differed from the one calculated a byte at a time.
+*/
+struct CNCCRCBenchmarkStruct {
+	bool							Verified;
+	unsigned int				BulkBytes;
+	unsigned __int64			BulkMicroseconds;
+	unsigned int				BulkKBPerSecond;
+	int							Strings;
+	unsigned __int64			StringMicroseconds;
+	unsigned int				StringNanoseconds;
+};
+
+
+
+
 /**************************************************************************************
 **
 **  Carryover object.